@@ -859,7 +859,11 @@ id RLMAccessorContext::defaultValue(__unsafe_unretained NSString *const key) {
 
 id RLMAccessorContext::propertyValue(id obj, size_t propIndex,
                                      __unsafe_unretained RLMProperty *const prop) {
-    obj = RLMBridgeSwiftValue(obj) ?: obj;
+    if (obj != _lastValue) {
+        _lastValue = obj;
+        _lastBridgedValue = RLMBridgeSwiftValue(obj) ?: obj;
+    }
+    obj = _lastBridgedValue;
 
     // Property value from an NSArray
     if ([obj respondsToSelector:@selector(objectAtIndex:)]) {
@@ -1165,9 +1169,15 @@ RLMOptionalId RLMAccessorContext::value_for_property(__unsafe_unretained id cons
     return RLMOptionalId{value};
 }
 
-RLMOptionalId RLMAccessorContext::default_value_for_property(realm::ObjectSchema const&,
+RLMOptionalId RLMAccessorContext::default_value_for_property(realm::ObjectSchema const& objectSchema,
                                                              realm::Property const& prop)
 {
+    // Object::create() passes in one of our own schema's properties, so look
+    // up the existing name rather than building a new NSString for each one
+    auto& props = objectSchema.persisted_properties;
+    if (&objectSchema == _info.objectSchema && &prop >= props.data() && &prop < props.data() + props.size()) {
+        return RLMOptionalId{defaultValue(_info.rlmObjectSchema.properties[&prop - props.data()].name)};
+    }
     return RLMOptionalId{defaultValue(@(prop.name.c_str()))};
 }
 
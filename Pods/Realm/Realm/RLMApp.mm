@@ -38,6 +38,9 @@
 #import <realm/object-store/sync/app_user.hpp>
 #import <realm/object-store/sync/sync_manager.hpp>
 #import <realm/sync/config.hpp>
+#import <realm/util/bson/bson.hpp>
+
+#import <unordered_set>
 
 #if !defined(REALM_COCOA_VERSION)
 #import "RLMVersion.h"
@@ -47,13 +50,238 @@ using namespace realm;
 
 #pragma mark CocoaNetworkTransport
 namespace {
+    /// Which function calls the transport may coalesce and cache responses for.
+    struct FunctionCallOptions {
+        bool coalesce = false;
+        NSTimeInterval cacheTimeout = 0;
+        // User-defined functions which the developer has declared free of
+        // side effects. MongoDB service reads are always eligible.
+        std::unordered_set<std::string> cacheableFunctions;
+    };
+
     /// Internal transport struct to bridge RLMNetworkingTransporting to the GenericNetworkTransport.
     class CocoaNetworkTransport : public realm::app::GenericNetworkTransport {
     public:
-        CocoaNetworkTransport(id<RLMNetworkTransport> transport) : m_transport(transport) {}
+        CocoaNetworkTransport(id<RLMNetworkTransport> transport, FunctionCallOptions options = {})
+        : m_transport(transport)
+        , m_options(std::move(options))
+        , m_coalesce(m_options.coalesce)
+        , m_cacheTimeout(std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(m_options.cacheTimeout)))
+        , m_state(std::make_shared<State>())
+        {}
 
         void send_request_to_server(const app::Request& request,
                                     util::UniqueFunction<void(const app::Response&)>&& completion) override {
+            if (!m_coalesce && m_cacheTimeout.count() <= 0) {
+                return send(request, std::move(completion));
+            }
+            auto action = cacheableAction(request);
+            if (!action) {
+                return send(request, std::move(completion));
+            }
+            if (!action->readOnly) {
+                // A write makes cached reads of the collection stale both
+                // immediately and once it has been applied, and reads which
+                // are in flight while it runs may observe either state
+                invalidate(*m_state, action->ns);
+                return send(request, [state = m_state, ns = std::move(action->ns),
+                                      completion = std::move(completion)](const app::Response& response) mutable {
+                    invalidate(*state, ns);
+                    completion(response);
+                });
+            }
+
+            // Reads are identified by everything which is sent, so requests
+            // for different users never share a response as their auth
+            // headers differ
+            std::string key = requestKey(request);
+            std::string inFlightKey;
+            uint64_t generation;
+            std::optional<app::Response> cached;
+            {
+                std::lock_guard lock(m_state->mutex);
+                generation = m_state->generations[action->ns];
+                auto now = std::chrono::steady_clock::now();
+                if (auto it = m_state->cache.find(key); it != m_state->cache.end()) {
+                    if (it->second.expires > now) {
+                        cached = it->second.response;
+                    }
+                    else {
+                        m_state->cache.erase(it);
+                    }
+                }
+                if (!cached && m_coalesce) {
+                    // Reads started after a write must not join one which
+                    // started before it
+                    inFlightKey = key + '\0' + std::to_string(generation);
+                    auto [it, inserted] = m_state->inFlight.try_emplace(inFlightKey);
+                    it->second.push_back(std::move(completion));
+                    if (!inserted) {
+                        return;
+                    }
+                }
+            }
+            if (cached) {
+                return completion(*cached);
+            }
+
+            send(request, [state = m_state, key = std::move(key), inFlightKey = std::move(inFlightKey),
+                           ns = std::move(action->ns), generation, timeout = m_cacheTimeout,
+                           completion = std::move(completion)](const app::Response& response) mutable {
+                std::vector<util::UniqueFunction<void(const app::Response&)>> waiters;
+                {
+                    std::lock_guard lock(state->mutex);
+                    bool success = response.custom_status_code == 0 && response.http_status_code >= 200 &&
+                                   response.http_status_code < 300;
+                    if (timeout.count() > 0 && success && state->generations[ns] == generation) {
+                        auto now = std::chrono::steady_clock::now();
+                        std::erase_if(state->cache, [&](auto& entry) {
+                            return entry.second.expires <= now;
+                        });
+                        if (state->cache.size() >= maxCachedResponses && !state->cache.count(key)) {
+                            // Every entry has the same timeout, so the one
+                            // expiring soonest is the oldest
+                            state->cache.erase(std::min_element(state->cache.begin(), state->cache.end(),
+                                                                [](auto& a, auto& b) {
+                                return a.second.expires < b.second.expires;
+                            }));
+                        }
+                        state->cache[key] = {response, now + timeout, std::move(ns)};
+                    }
+                    if (!inFlightKey.empty()) {
+                        if (auto node = state->inFlight.extract(inFlightKey)) {
+                            waiters = std::move(node.mapped());
+                        }
+                    }
+                }
+                if (completion) {
+                    completion(response);
+                }
+                for (auto& waiter : waiters) {
+                    waiter(response);
+                }
+            });
+        }
+
+        id<RLMNetworkTransport> transport() const {
+            return m_transport;
+        }
+
+        const FunctionCallOptions& functionCallOptions() const {
+            return m_options;
+        }
+    private:
+        static constexpr size_t maxCachedResponses = 256;
+
+        struct CachedResponse {
+            app::Response response;
+            std::chrono::steady_clock::time_point expires;
+            std::string ns;
+        };
+        // Shared with the completion handlers of requests which are in flight
+        // so that it outlives the transport if the App is torn down first
+        struct State {
+            std::mutex mutex;
+            std::unordered_map<std::string, std::vector<util::UniqueFunction<void(const app::Response&)>>> inFlight;
+            std::unordered_map<std::string, CachedResponse> cache;
+            // Bumped by every write to a collection so that reads which were
+            // in flight during the write are not cached
+            std::unordered_map<std::string, uint64_t> generations;
+        };
+
+        // A function call which may be eligible for coalescing and caching
+        struct CacheableAction {
+            bool readOnly;
+            // The service, database and collection a MongoDB action targets,
+            // or empty for user-defined functions
+            std::string ns;
+        };
+
+        id<RLMNetworkTransport> m_transport;
+        const FunctionCallOptions m_options;
+        const bool m_coalesce;
+        const std::chrono::steady_clock::duration m_cacheTimeout;
+        std::shared_ptr<State> m_state;
+
+        // Only MongoDB service reads and user-defined functions which are in
+        // the allowlist are eligible for coalescing and caching, as other
+        // functions may have side effects which callers expect to happen once
+        // per call. MongoDB writes are reported so that they can invalidate
+        // cached reads of the same collection.
+        std::optional<CacheableAction> cacheableAction(const app::Request& request) const {
+            if (request.method != app::HttpMethod::post
+                || std::string_view(request.url).find("/functions/call") == std::string_view::npos) {
+                return std::nullopt;
+            }
+            bson::Bson body;
+            try {
+                body = bson::parse(request.body);
+            }
+            catch (std::exception const&) {
+                return std::nullopt;
+            }
+            if (body.type() != bson::Bson::Type::Document) {
+                return std::nullopt;
+            }
+            auto& document = static_cast<const bson::BsonDocument&>(body);
+            auto name = document.find("name");
+            if (!name || name->type() != bson::Bson::Type::String) {
+                return std::nullopt;
+            }
+            auto& actionName = static_cast<const std::string&>(*name);
+            auto service = document.find("service");
+            if (!service) {
+                if (m_options.cacheableFunctions.count(actionName)) {
+                    return CacheableAction{true, {}};
+                }
+                return std::nullopt;
+            }
+            if (service->type() != bson::Bson::Type::String) {
+                return std::nullopt;
+            }
+
+            CacheableAction action;
+            action.ns = static_cast<const std::string&>(*service);
+            auto arguments = document.find("arguments");
+            if (arguments && arguments->type() == bson::Bson::Type::Array) {
+                auto& array = static_cast<const bson::BsonArray&>(*arguments);
+                if (!array.empty() && array[0].type() == bson::Bson::Type::Document) {
+                    auto& options = static_cast<const bson::BsonDocument&>(array[0]);
+                    for (auto field : {"database", "collection"}) {
+                        action.ns.append(1, '\0');
+                        if (auto value = options.find(field); value && value->type() == bson::Bson::Type::String) {
+                            action.ns.append(static_cast<const std::string&>(*value));
+                        }
+                    }
+                }
+            }
+
+            action.readOnly = actionName == "find" || actionName == "findOne" || actionName == "count"
+                           || (actionName == "aggregate" && request.body.find("\"$out\"") == std::string::npos
+                               && request.body.find("\"$merge\"") == std::string::npos);
+            return action;
+        }
+
+        static void invalidate(State& state, const std::string& ns) {
+            std::lock_guard lock(state.mutex);
+            ++state.generations[ns];
+            std::erase_if(state.cache, [&](auto& entry) {
+                return entry.second.ns == ns;
+            });
+        }
+
+        static std::string requestKey(const app::Request& request) {
+            std::string key = request.url;
+            for (auto& [name, value] : request.headers) {
+                key.append(1, '\0').append(name).append(1, '\0').append(value);
+            }
+            key.append(1, '\0').append(request.body);
+            return key;
+        }
+
+        void send(const app::Request& request,
+                  util::UniqueFunction<void(const app::Response&)>&& completion) {
             // Convert the app::Request to an RLMRequest
             auto rlmRequest = [RLMRequest new];
             rlmRequest.url = @(request.url.data());
@@ -85,12 +313,6 @@ namespace {
                 });
             }];
         }
-
-        id<RLMNetworkTransport> transport() const {
-            return m_transport;
-        }
-    private:
-        id<RLMNetworkTransport> m_transport;
     };
 }
 
@@ -234,7 +456,56 @@ static void setOptionalString(std::optional<std::string>& dst, NSString *src) {
     if (!transport) {
         transport = [RLMNetworkTransport new];
     }
-    _config.transport = std::make_shared<CocoaNetworkTransport>(transport);
+    FunctionCallOptions options;
+    if (_config.transport) {
+        options = static_cast<CocoaNetworkTransport&>(*_config.transport).functionCallOptions();
+    }
+    _config.transport = std::make_shared<CocoaNetworkTransport>(transport, std::move(options));
+}
+
+- (void)updateFunctionCallOptions:(void (^)(FunctionCallOptions&))update {
+    auto& current = static_cast<CocoaNetworkTransport&>(*self.config.transport);
+    auto options = current.functionCallOptions();
+    update(options);
+    _config.transport = std::make_shared<CocoaNetworkTransport>(current.transport(), std::move(options));
+}
+
+- (BOOL)coalesceFunctionCalls {
+    return static_cast<CocoaNetworkTransport&>(*self.config.transport).functionCallOptions().coalesce;
+}
+
+- (void)setCoalesceFunctionCalls:(BOOL)coalesceFunctionCalls {
+    [self updateFunctionCallOptions:^(FunctionCallOptions& options) {
+        options.coalesce = coalesceFunctionCalls;
+    }];
+}
+
+- (NSTimeInterval)functionCallCacheTimeout {
+    return static_cast<CocoaNetworkTransport&>(*self.config.transport).functionCallOptions().cacheTimeout;
+}
+
+- (void)setFunctionCallCacheTimeout:(NSTimeInterval)functionCallCacheTimeout {
+    [self updateFunctionCallOptions:^(FunctionCallOptions& options) {
+        options.cacheTimeout = functionCallCacheTimeout;
+    }];
+}
+
+- (NSSet<NSString *> *)cacheableFunctionNames {
+    auto& names = static_cast<CocoaNetworkTransport&>(*self.config.transport).functionCallOptions().cacheableFunctions;
+    NSMutableSet *set = [NSMutableSet setWithCapacity:names.size()];
+    for (auto& name : names) {
+        [set addObject:RLMStringViewToNSString(name)];
+    }
+    return set;
+}
+
+- (void)setCacheableFunctionNames:(NSSet<NSString *> *)cacheableFunctionNames {
+    [self updateFunctionCallOptions:^(FunctionCallOptions& options) {
+        options.cacheableFunctions.clear();
+        for (NSString *name in cacheableFunctionNames) {
+            options.cacheableFunctions.insert(name.UTF8String);
+        }
+    }];
 }
 
 - (NSUInteger)defaultRequestTimeoutMS {
@@ -68,6 +68,10 @@
     return (RLMObject *)RLMCreateObjectInRealmWithValue(realm, [self className], value, RLMUpdatePolicyError);
 }
 
++ (NSArray *)createInRealm:(RLMRealm *)realm withValues:(id<NSFastEnumeration>)values {
+    return RLMCreateObjectsInRealmWithValues(realm, [self className], values, RLMUpdatePolicyError);
+}
+
 + (instancetype)createOrUpdateInDefaultRealmWithValue:(id)value {
     return [self createOrUpdateInRealm:[RLMRealm defaultRealm] withValue:value];
 }
@@ -86,6 +90,16 @@
     return (RLMObject *)RLMCreateObjectInRealmWithValue(realm, [self className], value, RLMUpdatePolicyUpdateChanged);
 }
 
++ (NSArray *)createOrUpdateInRealm:(RLMRealm *)realm withValues:(id<NSFastEnumeration>)values {
+    RLMVerifyHasPrimaryKey(self);
+    return RLMCreateObjectsInRealmWithValues(realm, [self className], values, RLMUpdatePolicyUpdateAll);
+}
+
++ (NSArray *)createOrUpdateModifiedInRealm:(RLMRealm *)realm withValues:(id<NSFastEnumeration>)values {
+    RLMVerifyHasPrimaryKey(self);
+    return RLMCreateObjectsInRealmWithValues(realm, [self className], values, RLMUpdatePolicyUpdateChanged);
+}
+
 #pragma mark - Subscripting
 
 - (id)objectForKeyedSubscript:(NSString *)key {
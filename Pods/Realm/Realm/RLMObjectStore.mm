@@ -118,6 +118,18 @@ void RLMAddObjectToRealm(__unsafe_unretained RLMObjectBase *const object,
     c.createObject(object, createPolicy);
 }
 
+static RLMObjectBase *createObjectWithValue(RLMAccessorContext& c, RLMClassInfo& info,
+                                            id value, CreatePolicy createPolicy) {
+    RLMObjectBase *object = RLMCreateManagedAccessor(info.rlmObjectSchema.accessorClass, &info);
+    auto [obj, reuseExisting] = c.createObject(value, createPolicy, true);
+    if (reuseExisting) {
+        return value;
+    }
+    object->_row = std::move(obj);
+    RLMInitializeSwiftAccessor(object, false);
+    return object;
+}
+
 RLMObjectBase *RLMCreateObjectInRealmWithValue(RLMRealm *realm, NSString *className,
                                                id value, RLMUpdatePolicy updatePolicy) {
     RLMVerifyInWriteTransaction(realm);
@@ -127,14 +139,26 @@ RLMObjectBase *RLMCreateObjectInRealmWithValue(RLMRealm *realm, NSString *classN
 
     auto& info = realm->_info[className];
     RLMAccessorContext c{info};
-    RLMObjectBase *object = RLMCreateManagedAccessor(info.rlmObjectSchema.accessorClass, &info);
-    auto [obj, reuseExisting] = c.createObject(value, createPolicy, true);
-    if (reuseExisting) {
-        return value;
+    return createObjectWithValue(c, info, value, createPolicy);
+}
+
+NSArray *RLMCreateObjectsInRealmWithValues(RLMRealm *realm, NSString *className,
+                                           id<NSFastEnumeration> values, RLMUpdatePolicy updatePolicy) {
+    RLMVerifyInWriteTransaction(realm);
+
+    CreatePolicy createPolicy = updatePolicyToCreatePolicy(updatePolicy);
+    createPolicy.copy = true;
+
+    // A single context is used for every object so that the default property
+    // values, which for Swift classes requires constructing an instance of the
+    // class, are only computed once
+    auto& info = realm->_info[className];
+    RLMAccessorContext c{info};
+    NSMutableArray *objects = [NSMutableArray new];
+    for (id value in values) {
+        [objects addObject:createObjectWithValue(c, info, value, createPolicy)];
     }
-    object->_row = std::move(obj);
-    RLMInitializeSwiftAccessor(object, false);
-    return object;
+    return objects;
 }
 
 void RLMCreateAsymmetricObjectInRealm(RLMRealm *realm, NSString *className, id value) {
@@ -181,6 +205,64 @@ void RLMDeleteObjectFromRealm(__unsafe_unretained RLMObjectBase *const object,
     object->_realm = nil;
 }
 
+void RLMDeleteObjectsFromRealm(__unsafe_unretained id<NSFastEnumeration> const objects,
+                               __unsafe_unretained RLMRealm *const realm) {
+    // Validate and collect everything up front so that the accessors being
+    // enumerated are not invalidated mid-enumeration, and so that all of the
+    // objects in a table can be removed with a single batch erase which does
+    // one cascade and backlink pass rather than one per object.
+    std::vector<RLMObjectBase *> accessors;
+    std::unordered_map<RLMClassInfo *, std::vector<realm::ObjKey>> keysByTable;
+    for (RLMObjectBase *obj in objects) {
+        // Deleting nothing is allowed outside of a write transaction
+        if (accessors.empty()) {
+            RLMVerifyInWriteTransaction(realm);
+        }
+        if (![obj isKindOfClass:RLMObjectBase.class]) {
+            @throw RLMException(@"Cannot delete objects of type %@ with deleteObjects:. Only RLMObjects can be deleted.",
+                                NSStringFromClass(obj.class));
+        }
+        if (realm != obj->_realm) {
+            @throw RLMException(@"Can only delete an object from the Realm it belongs to.");
+        }
+        if (obj->_row.is_valid()) {
+            keysByTable[obj->_info].push_back(obj->_row.get_key());
+        }
+        accessors.push_back(obj);
+    }
+
+    if (!keysByTable.empty()) {
+        RLMObservationTracker tracker(realm, true);
+        for (auto& [info, keys] : keysByTable) {
+            auto table = info->table();
+            std::sort(keys.begin(), keys.end());
+            keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+            // Deleting an object from one table may have cascaded to an
+            // embedded object which was also in the list
+            keys.erase(std::remove_if(keys.begin(), keys.end(),
+                                      [&](auto key) { return !table->is_valid(key); }),
+                       keys.end());
+            if (table->is_embedded()) {
+                // Embedded objects may own other objects in the same table,
+                // so remove them one at a time and skip any which have
+                // already been removed by an earlier cascade
+                for (auto key : keys) {
+                    if (table->is_valid(key)) {
+                        table->remove_object(key);
+                    }
+                }
+            }
+            else if (!keys.empty()) {
+                table->batch_erase_objects(keys);
+            }
+        }
+    }
+
+    for (RLMObjectBase *obj : accessors) {
+        obj->_realm = nil;
+    }
+}
+
 void RLMDeleteAllObjectsFromRealm(RLMRealm *realm) {
     RLMVerifyInWriteTransaction(realm);
 
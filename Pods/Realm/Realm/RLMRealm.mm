@@ -240,6 +240,8 @@ bool copySeedFile(RLMRealmConfiguration *configuration, NSError **error) {
     std::mutex _collectionEnumeratorMutex;
     NSHashTable<RLMFastEnumerator *> *_collectionEnumerators;
     bool _sendingNotifications;
+    std::once_flag _pathOnce;
+    NSString *_path;
 }
 
 + (void)initialize {
@@ -588,6 +590,14 @@ bool copySeedFile(RLMRealmConfiguration *configuration, NSError **error) {
     }
 }
 
+- (NSString *)path {
+    // Frozen Realms may be used from multiple threads at once
+    std::call_once(_pathOnce, [&] {
+        _path = @(_realm->config().path.c_str());
+    });
+    return _path;
+}
+
 - (RLMRealmConfiguration *)configuration {
     RLMRealmConfiguration *configuration = [[RLMRealmConfiguration alloc] init];
     configuration.configRef = _realm->config();
@@ -803,6 +813,10 @@ bool copySeedFile(RLMRealmConfiguration *configuration, NSError **error) {
     return [reference resolveReferenceInRealm:self];
 }
 
+- (NSArray *)resolveThreadSafeReferences:(NSArray<RLMThreadSafeReference *> *)references {
+    return [RLMThreadSafeReference resolveReferences:references inRealm:self];
+}
+
 /**
  Replaces all string columns in this Realm with a string enumeration column and compacts the
  database file.
@@ -929,18 +943,10 @@ bool copySeedFile(RLMRealmConfiguration *configuration, NSError **error) {
             @throw RLMException(@"Cannot delete objects from RLMDictionary of type %@: only RLMObjects can be deleted.",
                                 RLMTypeToString(dictionary.type));
         }
-        for (RLMObject *obj in dictionary.allValues) {
-            RLMDeleteObjectFromRealm(obj, self);
-        }
+        RLMDeleteObjectsFromRealm(dictionary.allValues, self);
         return;
     }
-    for (RLMObject *obj in objects) {
-        if (![obj isKindOfClass:RLMObjectBase.class]) {
-            @throw RLMException(@"Cannot delete objects of type %@ with deleteObjects:. Only RLMObjects can be deleted.",
-                                NSStringFromClass(obj.class));
-        }
-        RLMDeleteObjectFromRealm(obj, self);
-    }
+    RLMDeleteObjectsFromRealm(objects, self);
 }
 
 - (void)deleteAllObjects {
@@ -35,10 +35,13 @@
 #import "RLMThreadSafeReference_Private.hpp"
 #import "RLMUtil.hpp"
 
+#import <realm/aggregate_ops.hpp>
 #import <realm/object-store/results.hpp>
 #import <realm/object-store/shared_realm.hpp>
 #import <realm/table_view.hpp>
 
+#import <unordered_map>
+
 #import <objc/message.h>
 
 using namespace realm;
@@ -60,6 +63,127 @@ using namespace realm;
 @property (nonatomic, nullable) RLMObjectId *associatedSubscriptionId;
 @end
 
+namespace {
+struct GroupedAggregate {
+    enum class Op { Count, Min, Max, Sum, Average };
+    Op op;
+    ColKey column;
+    RLMPropertyType type;
+};
+
+// Running value of one aggregate within one group. Sums are accumulated in the
+// same types as Results::sum() and Results::average() use so that grouped and
+// ungrouped aggregates agree.
+struct GroupedAccumulator {
+    size_t count = 0;
+    int64_t intSum = 0;
+    double doubleSum = 0;
+    Decimal128 decimalSum{0};
+    Mixed extreme;
+
+    void accumulate(GroupedAggregate const& aggregate, Mixed value) {
+        if (aggregate.op == GroupedAggregate::Op::Count) {
+            ++count;
+            return;
+        }
+        if (!aggregate_operations::valid_for_agg(value)
+            || (value.is_type(type_Float) && std::isnan(value.get_float()))
+            || (value.is_type(type_Double) && std::isnan(value.get_double()))) {
+            return;
+        }
+        switch (aggregate.op) {
+            case GroupedAggregate::Op::Min:
+                if (extreme.is_null() || value.compare(extreme) < 0) {
+                    extreme = value;
+                }
+                break;
+            case GroupedAggregate::Op::Max:
+                if (extreme.is_null() || value.compare(extreme) > 0) {
+                    extreme = value;
+                }
+                break;
+            case GroupedAggregate::Op::Sum:
+            case GroupedAggregate::Op::Average:
+                if (aggregate.type == RLMPropertyTypeAny) {
+                    if (value.accumulate_numeric_to(decimalSum)) {
+                        ++count;
+                    }
+                    break;
+                }
+                ++count;
+                if (value.is_type(type_Int)) {
+                    intSum = int64_t(uint64_t(intSum) + uint64_t(value.get_int()));
+                    doubleSum += double(value.get_int());
+                }
+                else if (value.is_type(type_Float)) {
+                    doubleSum += value.get_float();
+                }
+                else if (value.is_type(type_Double)) {
+                    doubleSum += value.get_double();
+                }
+                else if (value.is_type(type_Decimal)) {
+                    decimalSum += value.get_decimal();
+                }
+                break;
+            case GroupedAggregate::Op::Count:
+                break;
+        }
+    }
+
+    id result(GroupedAggregate const& aggregate, RLMRealm *realm, RLMClassInfo& info) const {
+        switch (aggregate.op) {
+            case GroupedAggregate::Op::Count:
+                return @(count);
+            case GroupedAggregate::Op::Min:
+            case GroupedAggregate::Op::Max:
+                return extreme.is_null() ? NSNull.null : RLMMixedToObjc(extreme, realm, &info);
+            case GroupedAggregate::Op::Sum:
+                switch (aggregate.type) {
+                    case RLMPropertyTypeInt:        return @(intSum);
+                    case RLMPropertyTypeFloat:
+                    case RLMPropertyTypeDouble:     return @(doubleSum);
+                    default:                        return RLMMixedToObjc(Mixed(decimalSum));
+                }
+            case GroupedAggregate::Op::Average:
+                if (count == 0) {
+                    return NSNull.null;
+                }
+                switch (aggregate.type) {
+                    case RLMPropertyTypeInt:
+                    case RLMPropertyTypeFloat:
+                    case RLMPropertyTypeDouble:     return @(doubleSum / count);
+                    default:                        return RLMMixedToObjc(Mixed(decimalSum / count));
+                }
+        }
+        REALM_UNREACHABLE();
+    }
+};
+
+struct GroupKeyHash {
+    size_t operator()(std::vector<Mixed> const& key) const {
+        size_t hash = 0;
+        for (auto& value : key) {
+            hash = hash * 31 + value.hash();
+        }
+        return hash;
+    }
+};
+} // anonymous namespace
+
+@implementation RLMAggregateGroup
+- (instancetype)initWithKeys:(NSArray *)keys values:(NSDictionary<NSString *, id> *)values {
+    if (self = [super init]) {
+        _keys = keys;
+        _values = values;
+    }
+    return self;
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"RLMAggregateGroup(keys: %@, values: %@)", _keys, _values];
+}
+@end
+
 //
 // RLMResults implementation
 //
@@ -464,6 +588,114 @@ returnNilForEmpty:(BOOL)returnNilForEmpty {
     return [self aggregate:property method:&Results::average returnNilForEmpty:YES];
 }
 
+- (NSArray *)aggregates:(NSArray<NSString *> *)aggregates groupedByProperties:(NSArray<NSString *> *)properties {
+    if (_results.get_mode() == Results::Mode::Empty) {
+        return @[];
+    }
+    if (self.type != RLMPropertyTypeObject) {
+        @throw RLMException(@"Grouped aggregates are only supported on Results of Realm Objects");
+    }
+
+    auto propertyNamed = [&](NSString *name) {
+        RLMProperty *property = _info->rlmObjectSchema[name];
+        if (!property) {
+            @throw RLMException(@"Invalid property name '%@' for class '%@'.",
+                                name, _info->rlmObjectSchema.className);
+        }
+        if (property.collection || property.type == RLMPropertyTypeObject
+            || property.type == RLMPropertyTypeLinkingObjects) {
+            @throw RLMException(@"Cannot group or aggregate by property '%@': object and collection properties are not supported.",
+                                name);
+        }
+        return property;
+    };
+
+    std::vector<ColKey> groupColumns;
+    groupColumns.reserve(properties.count);
+    for (NSString *name in properties) {
+        groupColumns.push_back(_info->tableColumn(propertyNamed(name)));
+    }
+
+    std::vector<GroupedAggregate> specs;
+    specs.reserve(aggregates.count);
+    for (NSString *aggregate in aggregates) {
+        if ([aggregate isEqualToString:@"@count"]) {
+            specs.push_back({GroupedAggregate::Op::Count, ColKey(), RLMPropertyTypeInt});
+            continue;
+        }
+
+        NSRange dot = [aggregate rangeOfString:@"."];
+        NSString *opName = dot.location == NSNotFound ? aggregate : [aggregate substringToIndex:dot.location];
+        auto op = GroupedAggregate::Op::Count;
+        if ([opName isEqualToString:@"@sum"]) {
+            op = GroupedAggregate::Op::Sum;
+        }
+        else if ([opName isEqualToString:@"@avg"]) {
+            op = GroupedAggregate::Op::Average;
+        }
+        else if ([opName isEqualToString:@"@min"]) {
+            op = GroupedAggregate::Op::Min;
+        }
+        else if ([opName isEqualToString:@"@max"]) {
+            op = GroupedAggregate::Op::Max;
+        }
+        else {
+            dot.location = NSNotFound;
+        }
+        if (dot.location == NSNotFound) {
+            @throw RLMException(@"Unsupported aggregate '%@': must be '@count' or one of '@sum', '@avg', '@min' and '@max' followed by a property name.",
+                                aggregate);
+        }
+
+        RLMProperty *property = propertyNamed([aggregate substringFromIndex:dot.location + 1]);
+        bool numeric = property.type == RLMPropertyTypeInt || property.type == RLMPropertyTypeFloat
+                    || property.type == RLMPropertyTypeDouble || property.type == RLMPropertyTypeDecimal128
+                    || property.type == RLMPropertyTypeAny;
+        bool comparable = property.type == RLMPropertyTypeDate
+                       && (op == GroupedAggregate::Op::Min || op == GroupedAggregate::Op::Max);
+        if (!numeric && !comparable) {
+            @throw RLMException(@"Cannot compute '%@': aggregate not supported for property '%@' of type '%@'.",
+                                aggregate, property.name, RLMTypeToString(property.type));
+        }
+        specs.push_back({op, _info->tableColumn(property), property.type});
+    }
+
+    return translateErrors([&] {
+        // Hash aggregation over a single pass of the matching objects, rather
+        // than one query per group or one Results::sum() per aggregate
+        std::unordered_map<std::vector<Mixed>, std::vector<GroupedAccumulator>, GroupKeyHash> groups;
+        std::vector<Mixed> key(groupColumns.size());
+        auto tv = _results.get_tableview();
+        for (size_t i = 0, size = tv.size(); i < size; ++i) {
+            Obj obj = tv.get_object(i);
+            for (size_t j = 0; j < groupColumns.size(); ++j) {
+                key[j] = obj.get_any(groupColumns[j]);
+            }
+            auto& accumulators = groups.try_emplace(key, specs.size()).first->second;
+            for (size_t j = 0; j < specs.size(); ++j) {
+                auto& spec = specs[j];
+                accumulators[j].accumulate(spec, spec.column ? obj.get_any(spec.column) : Mixed());
+            }
+        }
+
+        // Boxed keys are not used as dictionary keys as different Mixed values
+        // can box to equal objects, such as true and 1
+        NSMutableArray *result = [NSMutableArray arrayWithCapacity:groups.size()];
+        for (auto& [groupKey, accumulators] : groups) {
+            NSMutableArray *keyValues = [NSMutableArray arrayWithCapacity:groupKey.size()];
+            for (auto& value : groupKey) {
+                [keyValues addObject:value.is_null() ? NSNull.null : RLMMixedToObjc(value, _realm, _info)];
+            }
+            NSMutableDictionary *values = [NSMutableDictionary dictionaryWithCapacity:specs.size()];
+            for (size_t j = 0; j < specs.size(); ++j) {
+                values[aggregates[j]] = accumulators[j].result(specs[j], _realm, *_info);
+            }
+            [result addObject:[[RLMAggregateGroup alloc] initWithKeys:keyValues values:values]];
+        }
+        return result;
+    });
+}
+
 - (RLMSectionedResults *)sectionedResultsSortedUsingKeyPath:(NSString *)keyPath
                                                   ascending:(BOOL)ascending
                                                    keyBlock:(RLMSectionedResultsKeyBlock)keyBlock {
@@ -17,12 +17,28 @@
 ////////////////////////////////////////////////////////////////////////////
 
 #import "RLMThreadSafeReference_Private.hpp"
+
+#import "RLMClassInfo.hpp"
+#import "RLMObjectStore.h"
+#import "RLMObject_Private.hpp"
+#import "RLMRealm_Private.hpp"
 #import "RLMUtil.hpp"
 
+#import <realm/object-store/shared_realm.hpp>
+
 @implementation RLMThreadSafeReference {
     realm::ThreadSafeReference _reference;
     id _metadata;
     Class _type;
+
+    // For object references, enough information to import the object without
+    // going through the object store payload once the target Realm is known
+    // to be at a suitable version. Unset for collections and Results.
+    NSString *_path;
+    realm::VersionID _version;
+    bool _createdInWriteTransaction;
+    realm::TableKey _tableKey;
+    realm::ObjKey _objKey;
 }
 
 - (instancetype)initWithThreadConfined:(id<RLMThreadConfined>)threadConfined {
@@ -46,6 +62,16 @@
     });
     _type = threadConfined.class;
 
+    if ([threadConfined isKindOfClass:[RLMObjectBase class]]) {
+        auto obj = (RLMObjectBase *)threadConfined;
+        auto& realm = *obj->_realm->_realm;
+        _path = obj->_realm.path;
+        _version = realm.read_transaction_version();
+        _createdInWriteTransaction = realm.is_in_transaction();
+        _tableKey = obj->_row.get_table()->get_key();
+        _objKey = obj->_row.get_key();
+    }
+
     return self;
 }
 
@@ -66,4 +92,50 @@
     return !_reference;
 }
 
+// Mirrors the check the object store performs before importing a reference:
+// if it would not need to refresh or begin a read on the target Realm, the
+// object can be looked up directly by key.
+- (bool)canResolveByKeyInRealm:(realm::Realm&)realm path:(NSString *)path {
+    if (!_objKey || realm.is_in_transaction() || !realm.is_in_read_transaction()) {
+        return false;
+    }
+    if (![_path isEqualToString:path]) {
+        return false;
+    }
+    auto version = realm.read_transaction_version().version;
+    return version > _version.version || (version == _version.version && !_createdInWriteTransaction);
+}
+
++ (NSArray *)resolveReferences:(NSArray<RLMThreadSafeReference *> *)references inRealm:(RLMRealm *)realm {
+    NSMutableArray *ret = [NSMutableArray arrayWithCapacity:references.count];
+    // The class info for each table is taken from the first object of that
+    // table resolved through the object store so that the accessor class
+    // matches what a single resolve would produce.
+    std::unordered_map<uint32_t, RLMClassInfo *> infoForTable;
+    NSString *path = realm.path;
+    for (RLMThreadSafeReference *reference in references) {
+        if (!reference->_reference) {
+            @throw RLMException(@"Can only resolve a thread safe reference once.");
+        }
+
+        auto it = infoForTable.find(reference->_tableKey.value);
+        if (it != infoForTable.end() && [reference canResolveByKeyInRealm:*realm->_realm path:path]) {
+            reference->_reference = {};
+            id obj = RLMTranslateError([&]() -> id {
+                auto row = it->second->table()->try_get_object(reference->_objKey);
+                return row.is_valid() ? RLMCreateObjectAccessor(*it->second, row) : nil;
+            });
+            [ret addObject:obj ?: NSNull.null];
+            continue;
+        }
+
+        id obj = [reference resolveReferenceInRealm:realm];
+        if (reference->_objKey && obj) {
+            infoForTable.emplace(reference->_tableKey.value, ((RLMObjectBase *)obj)->_info);
+        }
+        [ret addObject:obj ?: NSNull.null];
+    }
+    return ret;
+}
+
 @end
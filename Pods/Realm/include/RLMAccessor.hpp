@@ -155,6 +155,12 @@ private:
     // for every property
     NSDictionary *_defaultValues;
 
+    // The most recent input value passed to propertyValue() and its bridged
+    // form, as bridging a Swift collection copies it and would otherwise be
+    // done once per property rather than once per object
+    id _lastValue;
+    id _lastBridgedValue;
+
     std::unique_ptr<RLMObservationTracker> _observationHelper;
 
     id defaultValue(NSString *key);
@@ -68,6 +68,43 @@ typedef void(^RLMOptionalErrorBlock)(NSError * _Nullable);
 /// default).
 @property (nonatomic, assign) BOOL enableSessionMultiplexing;
 
+/// If enabled, an eligible function call which is identical to one already in
+/// flight is not sent again, and instead completes with the response to the
+/// in-flight request. Requests are only considered identical if they have the
+/// same URL, headers and body, so calls made by different users are never
+/// combined.
+///
+/// Calls to the functions named in ``cacheableFunctionNames`` are eligible, as
+/// are read-only MongoDB service requests made via ``RLMMongoCollection``
+/// (`find`, `findOne`, `count`, and `aggregate` without a `$out` or `$merge`
+/// stage). MongoDB writes and all other functions are never combined, as they
+/// may have side effects which are expected to happen once per call. A
+/// MongoDB read made after a write to the same collection has been sent never
+/// shares a response with one made before it. Disabled by default.
+@property (nonatomic, assign) BOOL coalesceFunctionCalls;
+
+/// The number of seconds for which a successful response to an eligible
+/// function call is reused for identical calls rather than sending them again.
+/// The same rules for which calls are eligible and identical apply as for
+/// ``coalesceFunctionCalls``.
+///
+/// MongoDB writes made through this App discard the cached responses for the
+/// collection written to. Nothing discards the cached responses of functions
+/// in ``cacheableFunctionNames``, and changes made by other clients, by
+/// functions or by triggers are not observed, so responses may be up to this
+/// many seconds out of date. At most 256 responses are cached, and the oldest
+/// is discarded to make room for a new one. `0`, the default, disables
+/// caching.
+@property (nonatomic, assign) NSTimeInterval functionCallCacheTimeout;
+
+/// The names of user-defined functions whose calls may be coalesced and cached
+/// as described for ``coalesceFunctionCalls`` and ``functionCallCacheTimeout``.
+///
+/// Only list functions which have no side effects, as a call to one of them
+/// may be answered with the response to an earlier identical call without
+/// running the function. Empty by default.
+@property (nonatomic, copy) NSSet<NSString *> *cacheableFunctionNames;
+
 /**
  Options for the assorted types of connection timeouts for sync connections.
 
@@ -172,6 +172,23 @@ RLM_HEADER_AUDIT_BEGIN(nullability, sendability)
  */
 + (instancetype)createInRealm:(RLMRealm *)realm withValue:(id)value;
 
+/**
+ Creates an instance of a Realm object for each of the given values, and adds them to the specified Realm.
+
+ This is equivalent to calling `createInRealm:withValue:` for each value, but the
+ per-class setup such as reading `defaultPropertyValues` is done once rather than
+ once per object, which makes it much faster when creating many objects at once.
+
+ @param realm    The Realm which should manage the newly-created objects.
+ @param values   The values used to populate the objects, each in any of the
+                 forms accepted by `createInRealm:withValue:`.
+
+ @return The created objects, in the same order as `values`.
+
+ @see   `createInRealm:withValue:`
+ */
++ (NSArray *)createInRealm:(RLMRealm *)realm withValues:(id<NSFastEnumeration>)values;
+
 /**
  Creates or updates a Realm object within the default Realm.
 
@@ -338,6 +355,43 @@ RLM_HEADER_AUDIT_BEGIN(nullability, sendability)
  */
 + (instancetype)createOrUpdateModifiedInRealm:(RLMRealm *)realm withValue:(id)value;
 
+/**
+ Creates or updates a Realm object for each of the given values within a specified Realm.
+
+ This is equivalent to calling `createOrUpdateInRealm:withValue:` for each value, but the
+ per-class setup is done once rather than once per object.
+
+ This method may only be called on Realm object types with a primary key defined.
+
+ @param realm    The Realm which should own the objects.
+ @param values   The values used to populate the objects, each in any of the
+                 forms accepted by `createOrUpdateInRealm:withValue:`.
+
+ @return The created or updated objects, in the same order as `values`.
+
+ @see   `createOrUpdateInRealm:withValue:`, `createInRealm:withValues:`
+ */
++ (NSArray *)createOrUpdateInRealm:(RLMRealm *)realm withValues:(id<NSFastEnumeration>)values;
+
+/**
+ Creates or updates a Realm object for each of the given values within a specified Realm,
+ setting only the properties which have changed.
+
+ This is equivalent to calling `createOrUpdateModifiedInRealm:withValue:` for each value, but
+ the per-class setup is done once rather than once per object.
+
+ This method may only be called on Realm object types with a primary key defined.
+
+ @param realm    The Realm which should own the objects.
+ @param values   The values used to populate the objects, each in any of the
+                 forms accepted by `createOrUpdateModifiedInRealm:withValue:`.
+
+ @return The created or updated objects, in the same order as `values`.
+
+ @see   `createOrUpdateModifiedInRealm:withValue:`, `createInRealm:withValues:`
+ */
++ (NSArray *)createOrUpdateModifiedInRealm:(RLMRealm *)realm withValues:(id<NSFastEnumeration>)values;
+
 #pragma mark - Properties
 
 /**
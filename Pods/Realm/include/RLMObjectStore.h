@@ -46,6 +46,10 @@ void RLMAddObjectToRealm(RLMObjectBase *object, RLMRealm *realm, RLMUpdatePolicy
 // delete an object from its realm
 void RLMDeleteObjectFromRealm(RLMObjectBase *object, RLMRealm *realm);
 
+// delete all of the objects in the enumeration from the given realm, batching
+// the removal of objects which belong to the same table
+void RLMDeleteObjectsFromRealm(id<NSFastEnumeration> objects, RLMRealm *realm);
+
 // deletes all objects from a realm
 void RLMDeleteAllObjectsFromRealm(RLMRealm *realm);
 
@@ -61,6 +65,12 @@ RLMObjectBase *RLMCreateObjectInRealmWithValue(RLMRealm *realm, NSString *classN
                                                id _Nullable value, RLMUpdatePolicy updatePolicy)
 NS_RETURNS_RETAINED;
 
+// create objects from each of the values in the enumeration, sharing the
+// class lookup and default values between all of them
+NSArray *RLMCreateObjectsInRealmWithValues(RLMRealm *realm, NSString *className,
+                                           id<NSFastEnumeration> values, RLMUpdatePolicy updatePolicy)
+NS_RETURNS_RETAINED;
+
 // creates an asymmetric object and doesn't return
 void RLMCreateAsymmetricObjectInRealm(RLMRealm *realm, NSString *className, id value);
 
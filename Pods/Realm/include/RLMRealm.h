@@ -756,6 +756,25 @@ typedef void (^RLMNotificationBlock)(RLMNotification notification, RLMRealm *rea
 - (nullable id)resolveThreadSafeReference:(RLMThreadSafeReference *)reference
 NS_REFINED_FOR_SWIFT;
 
+/**
+ Resolves each of the given `RLMThreadSafeReference`s in this Realm, in order.
+
+ This is equivalent to calling `-resolveThreadSafeReference:` on each reference,
+ but objects are looked up directly by key once this Realm is at a version
+ suitable for them, so handing over many objects at once is much cheaper.
+
+ @param references The thread-safe references to resolve in this Realm.
+ @return An array with one entry per reference, containing `NSNull` for objects
+         which were deleted after the reference was created.
+
+ @warning Each `RLMThreadSafeReference` must be resolved at most once, and an
+          exception will be thrown if any of them has already been resolved.
+
+ @see `-resolveThreadSafeReference:`
+ */
+- (NSArray *)resolveThreadSafeReferences:(NSArray<RLMThreadSafeReference *> *)references
+NS_SWIFT_NAME(__resolveThreadSafeReferences(_:));
+
 #pragma mark - Adding and Removing Objects from a Realm
 
 /**
@@ -41,6 +41,8 @@ namespace realm {
     freeze:(bool)freeze NS_RETURNS_RETAINED;
 
 @property (nonatomic, readonly) realm::Group &group;
+// The path of the Realm file, created on first use and then shared
+@property (nonatomic, readonly) NSString *path;
 @end
 
 RLM_HEADER_AUDIT_END(nullability, sendability)
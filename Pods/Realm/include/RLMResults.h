@@ -41,6 +41,22 @@ typedef NS_ENUM(NSUInteger, RLMWaitForSyncMode) {
 
 @class RLMObject;
 
+/**
+ The aggregates computed for one group by
+ `-[RLMResults aggregates:groupedByProperties:]`.
+ */
+RLM_FINAL
+@interface RLMAggregateGroup : NSObject
+/// The values of the grouping properties for this group, in the order the
+/// properties were given, with `NSNull` for `nil`.
+@property (nonatomic, readonly) NSArray *keys;
+
+/// The result of each requested aggregate, keyed by the aggregate as it was
+/// given. `@min`, `@max` and `@avg` are `NSNull` when the group has no non-nil
+/// values for the property.
+@property (nonatomic, readonly) NSDictionary<NSString *, id> *values;
+@end
+
 /**
  `RLMResults` is an auto-updating container type in Realm returned from object
  queries. It represents the results of the query in the form of a collection of objects.
@@ -644,6 +660,37 @@ __attribute__((swift_attr("@_unsafeInheritExecutor")));
  */
 - (nullable NSNumber *)averageOfProperty:(NSString *)property;
 
+/**
+ Computes several aggregates for each distinct combination of values of the
+ given properties, in a single pass over the objects represented by the results
+ collection.
+
+     NSArray<RLMAggregateGroup *> *totals = [orders aggregates:@[@"@count", @"@sum.amount", @"@max.date"]
+                                            groupedByProperties:@[@"customerId"]];
+     for (RLMAggregateGroup *group in totals) {
+         NSLog(@"%@: %@ orders", group.keys[0], group.values[@"@count"]);
+     }
+
+ Each aggregate is either `@count`, or one of `@sum`, `@avg`, `@min` and
+ `@max` followed by a property name, such as `@sum.amount`. `@sum` and `@avg`
+ support `int`, `float`, `double`, `RLMDecimal128` and `RLMValue` properties;
+ `@min` and `@max` additionally support `NSDate` properties.
+
+ @warning Grouping and aggregate properties cannot be `RLMObject` properties,
+          collection properties or key paths through relationships.
+
+ @param aggregates The aggregates to compute for each group.
+ @param properties The properties whose values define the groups.
+
+ @return One `RLMAggregateGroup` for each distinct combination of grouping
+         values, in no particular order. Values which compare equal as
+         `NSNumber`s but have different types in an `RLMValue` property, such
+         as `true` and `1`, form separate groups.
+ */
+- (NSArray<RLMAggregateGroup *> *)aggregates:(NSArray<NSString *> *)aggregates
+                         groupedByProperties:(NSArray<NSString *> *)properties
+    NS_SWIFT_NAME(__aggregates(_:groupedByProperties:));
+
 /// :nodoc:
 - (RLMObjectType)objectAtIndexedSubscript:(NSUInteger)index;
 
@@ -40,6 +40,7 @@ RLM_HIDDEN
 RLM_DIRECT_MEMBERS
 @interface RLMThreadSafeReference ()
 - (nullable id<RLMThreadConfined>)resolveReferenceInRealm:(RLMRealm *)realm;
++ (NSArray *)resolveReferences:(NSArray<RLMThreadSafeReference *> *)references inRealm:(RLMRealm *)realm;
 @end
 
 RLM_HEADER_AUDIT_END(nullability, sendability)
@@ -619,6 +619,35 @@ public typealias AsyncTransactionId = RLMAsyncTransactionId
                                                               RLMUpdatePolicy(rawValue: UInt(update.rawValue))!), to: type)
     }
 
+    /**
+     Creates a Realm object for each of the given values, adding them to the Realm and returning them.
+
+     This is equivalent to calling `create(_:value:update:)` once for each value, but the
+     per-type setup such as computing the default property values is done once rather than once
+     per object, which makes it much faster when creating many objects at once.
+
+     - warning: This method may only be called during a write transaction.
+
+     - parameter type:   The type of the objects to create.
+     - parameter values: The values used to populate the objects, each in any of the forms accepted
+                         by `create(_:value:update:)`.
+     - parameter update: What to do if an object with the same primary key already exists. Must be `.error` for object
+     types without a primary key.
+
+     - returns: The created or updated objects, in the same order as `values`.
+     */
+    @discardableResult
+    public func create<T: Object>(_ type: T.Type, values: [Any], update: UpdatePolicy = .error) -> [T] {
+        if update != .error {
+            RLMVerifyHasPrimaryKey(type)
+        }
+        let typeName = (type as Object.Type).className()
+        return RLMCreateObjectsInRealmWithValues(rlmRealm, typeName, values as NSArray,
+                                                 RLMUpdatePolicy(rawValue: UInt(update.rawValue))!).map {
+            unsafeDowncast($0 as AnyObject, to: type)
+        }
+    }
+
     /**
      This method is useful only in specialized circumstances, for example, when building
      components that integrate with Realm. If you are simply building an app on Realm, it is
@@ -683,22 +712,19 @@ public typealias AsyncTransactionId = RLMAsyncTransactionId
     /**
      Deletes zero or more objects from the Realm.
 
-     Do not pass in a slice to a `Results` or any other auto-updating Realm collection
-     type (for example, the type returned by the Swift `suffix(_:)` standard library
-     method). Instead, make a copy of the objects to delete using `Array()`, and pass
-     that instead. Directly passing in a view into an auto-updating collection may
-     result in 'index out of bounds' exceptions being thrown.
+     The objects are copied out of the sequence before any are deleted, so a slice of a
+     `Results` or any other auto-updating Realm collection type (for example, the type
+     returned by the Swift `suffix(_:)` standard library method) can be passed directly.
 
-     - warning: This method may only be called during a write transaction.
+     - warning: This method may only be called during a write transaction, unless the
+                sequence is empty.
 
      - parameter objects:   The objects to be deleted. This can be a `List<Object>`,
                             `Results<Object>`, or any other Swift `Sequence` whose
-                            elements are `Object`s (subject to the caveats above).
+                            elements are `Object`s.
      */
     public func delete<S: Sequence>(_ objects: S) where S.Iterator.Element: ObjectBase {
-        for obj in objects {
-            delete(obj)
-        }
+        RLMDeleteObjectsFromRealm(Array(objects) as NSArray, rlmRealm)
     }
 
     /**
@@ -227,4 +227,39 @@ extension Projection: KeypathSortable {}
     }
 }
 
+extension Results where Element: ObjectBase {
+    /**
+     Computes several aggregates for each distinct combination of values of the given properties, in a single pass
+     over the objects represented by the results.
+
+     ```swift
+     let totals = orders.aggregates(["@count", "@sum.amount", "@max.date"], groupedBy: ["customerId"])
+     let count = totals[[.int(42)]]?["@count"]
+     ```
+
+     Each aggregate is either `@count`, or one of `@sum`, `@avg`, `@min` and `@max` followed by a property name, such
+     as `@sum.amount`. `@sum` and `@avg` support `Int`, `Float`, `Double`, `Decimal128` and `AnyRealmValue` properties;
+     `@min` and `@max` additionally support `Date` properties.
+
+     - warning: Grouping and aggregate properties cannot be `Object` properties, collection properties or key paths
+                through relationships.
+
+     - parameter aggregates: The aggregates to compute for each group.
+     - parameter properties: The properties whose values define the groups.
+     - returns: A dictionary whose keys hold the values of the grouping properties in the order given, and whose values
+                map each requested aggregate to its result. `@min`, `@max` and `@avg` are `.none` when a group has no
+                non-nil values for the property.
+     */
+    public func aggregates(_ aggregates: [String],
+                           groupedBy properties: [String]) -> [[AnyRealmValue]: [String: AnyRealmValue]] {
+        let rlmResults = ObjectiveCSupport.convert(object: self)
+        var result = [[AnyRealmValue]: [String: AnyRealmValue]]()
+        for group in rlmResults.__aggregates(aggregates, groupedByProperties: properties) {
+            let groupKey = group.keys.map { ObjectiveCSupport.convert(value: $0 as? RLMValue) }
+            result[groupKey] = group.values.mapValues { ObjectiveCSupport.convert(value: $0 as? RLMValue) }
+        }
+        return result
+    }
+}
+
 extension Results: Encodable where Element: Encodable {}
@@ -114,6 +114,14 @@ public protocol ThreadConfined {
         guard let resolved = realm.rlmRealm.__resolve(objectiveCReference) as? RLMThreadConfined else { return nil }
         return (Confined.self as! _ObjcBridgeable.Type)._rlmFromObjc(resolved).flatMap { $0 as? Confined }
     }
+
+    internal static func resolve(_ references: [ThreadSafeReference], in realm: Realm) -> [Confined?] {
+        let resolved = realm.rlmRealm.__resolveThreadSafeReferences(references.map { $0.objectiveCReference })
+        return resolved.map { value in
+            guard let value = value as? RLMThreadConfined else { return nil }
+            return (Confined.self as! _ObjcBridgeable.Type)._rlmFromObjc(value).flatMap { $0 as? Confined }
+        }
+    }
 }
 
 // MARK: ThreadSafe propertyWrapper
@@ -214,6 +222,26 @@ extension Realm {
     public func resolve<Confined>(_ reference: ThreadSafeReference<Confined>) -> Confined? {
         return reference.resolve(in: self)
     }
+
+    /**
+     Resolves each of the given `ThreadSafeReference`s in this Realm, in order.
+
+     This is equivalent to calling `resolve(_:)` on each reference, but objects are looked up
+     directly by key once this Realm is at a version suitable for them, so handing over many
+     objects at once is much cheaper.
+
+     - parameter references: The thread-safe references to resolve in this Realm.
+     - returns: One element per reference, which is `nil` if that object was deleted after the
+                reference was created.
+
+     - warning: Each `ThreadSafeReference` must be resolved at most once, and an exception will be
+                thrown if any of them has already been resolved.
+
+     - see: `resolve(_:)`
+     */
+    public func resolve<Confined>(_ references: [ThreadSafeReference<Confined>]) -> [Confined?] {
+        return ThreadSafeReference.resolve(references, in: self)
+    }
 }
 
 extension ThreadSafeReference: Sendable {